@@ -0,0 +1,374 @@
+#ifndef __Channel__
+#define __Channel__
+
+#include <condition_variable>
+#include <coroutine>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include "List.hpp"
+
+namespace LAZ {
+    // Bounded FIFO channel on top of LAZ::List.
+    // Threads use the blocking push/pop family, coroutines co_await send()/receive().
+    // A suspended coroutine holds no thread: it is resumed on the thread that
+    // made its operation complete (a producer for receive, a consumer for send).
+    // T needs to be default-constructible and movable; values are moved into
+    // and out of the queue.
+    // Suspended coroutines take priority over blocked threads: a freed slot goes
+    // to the oldest suspended sender and a new value to the oldest suspended
+    // receiver before push()/pop() threads are woken. Under mixed use a blocked
+    // thread can wait for as long as coroutines keep the channel busy.
+    // Destroying a channel closes it, so coroutines still suspended on it are
+    // resumed on the destroying thread. They must not touch the channel again
+    // once that resumption returns.
+    template<typename T>
+    class Channel {
+    public:
+        typedef int sizeType;
+        typedef T valueType;
+        typedef const T& constReference;
+    private:
+        struct Waiter {
+        public:
+            Waiter() : _next{nullptr}, _handle{} {}
+        public:
+            Waiter* _next;
+            std::coroutine_handle<> _handle;
+        };
+        struct WaitQueue {
+        public:
+            WaitQueue() : _first{nullptr}, _last{nullptr} {}
+        public:
+            bool empty() const { return (_first == nullptr); }
+            void push(Waiter* waiter);
+            Waiter* pop();
+        public:
+            Waiter* _first;
+            Waiter* _last;
+        };
+    public:
+        class SendAwaiter : public Waiter {
+        public:
+            SendAwaiter(Channel* channel, valueType value) : _channel{channel}, _value{std::move(value)}, _ok{false} {}
+        public:
+            bool await_ready() const { return false; }
+            bool await_suspend(std::coroutine_handle<> handle) { return _channel->suspendSender(this, handle); }
+            bool await_resume() const { return _ok; }
+        private:
+            friend class Channel;
+            Channel* _channel;
+            valueType _value;
+            bool _ok;
+        };
+        class ReceiveAwaiter : public Waiter {
+        public:
+            ReceiveAwaiter(Channel* channel) : _channel{channel}, _value{} {}
+        public:
+            bool await_ready() const { return false; }
+            bool await_suspend(std::coroutine_handle<> handle) { return _channel->suspendReceiver(this, handle); }
+            std::optional<valueType> await_resume() { return std::move(_value); }
+        private:
+            friend class Channel;
+            Channel* _channel;
+            std::optional<valueType> _value;
+        };
+    public:
+        explicit Channel(sizeType capacity) : _capacity{capacity > 0 ? capacity : 1}, _count{0}, _closed{false} {}
+        ~Channel() { close(); }
+        Channel(const Channel&) = delete;
+        Channel& operator=(const Channel&) = delete;
+    public:
+        sizeType capacity() const { return _capacity; }
+        sizeType size() const;
+        bool closed() const;
+        void close();
+        bool push(constReference value) { return push(valueType(value)); }
+        bool push(valueType&& value);
+        bool tryPush(constReference value) { return tryPush(valueType(value)); }
+        bool tryPush(valueType&& value);
+        template<typename Iter>
+        Iter pushMany(Iter begin, Iter end);
+        bool pop(valueType& value);
+        bool tryPop(valueType& value);
+        template<typename OutIter>
+        sizeType popMany(OutIter out, sizeType n);
+        SendAwaiter send(valueType value) { return SendAwaiter(this, std::move(value)); }
+        ReceiveAwaiter receive() { return ReceiveAwaiter(this); }
+    private:
+        bool suspendSender(SendAwaiter* sender, std::coroutine_handle<> handle);
+        bool suspendReceiver(ReceiveAwaiter* receiver, std::coroutine_handle<> handle);
+        void deliver(valueType&& value, WaitQueue& ready);
+        valueType take(WaitQueue& ready);
+        static void resume(WaitQueue& ready);
+    private:
+        List<valueType> _items;
+        sizeType _capacity;
+        sizeType _count;
+        bool _closed;
+        WaitQueue _senders;
+        WaitQueue _receivers;
+        mutable std::mutex _mutex;
+        std::condition_variable _notEmpty;
+        std::condition_variable _notFull;
+    };
+
+    // WAIT QUEUE
+    template<typename T>
+    void Channel<T>::WaitQueue::push(Waiter* waiter) {
+        waiter->_next = nullptr;
+        if(_last != nullptr) {
+            _last->_next = waiter;
+        } else {
+            _first = waiter;
+        }
+        _last = waiter;
+    }
+
+    template<typename T>
+    typename Channel<T>::Waiter* Channel<T>::WaitQueue::pop() {
+        Waiter* waiter = _first;
+        _first = waiter->_next;
+        if(_first == nullptr) {
+            _last = nullptr;
+        }
+        waiter->_next = nullptr;
+        return waiter;
+    }
+
+    // FUNCTIONS
+    template<typename T>
+    typename Channel<T>::sizeType Channel<T>::size() const {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _count;
+    }
+
+    template<typename T>
+    bool Channel<T>::closed() const {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _closed;
+    }
+
+    // Wakes every waiter. Values already queued can still be popped,
+    // pending coroutine sends complete with false.
+    template<typename T>
+    void Channel<T>::close() {
+        WaitQueue ready;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _closed = true;
+            while(!_receivers.empty()) {
+                ready.push(_receivers.pop());
+            }
+            while(!_senders.empty()) {
+                ready.push(_senders.pop());
+            }
+        }
+        _notEmpty.notify_all();
+        _notFull.notify_all();
+        resume(ready);
+    }
+
+    template<typename T>
+    bool Channel<T>::push(valueType&& value) {
+        WaitQueue ready;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _notFull.wait(lock, [this]() { return (_closed || _count < _capacity); });
+            if(_closed) {
+                return false;
+            }
+            deliver(std::move(value), ready);
+        }
+        _notEmpty.notify_one();
+        resume(ready);
+        return true;
+    }
+
+    // On failure value is left untouched.
+    template<typename T>
+    bool Channel<T>::tryPush(valueType&& value) {
+        WaitQueue ready;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if(_closed || _count == _capacity) {
+                return false;
+            }
+            deliver(std::move(value), ready);
+        }
+        _notEmpty.notify_one();
+        resume(ready);
+        return true;
+    }
+
+    // Sends [begin, end) taking the lock once per run of free slots rather than
+    // once per element. Returns the first element not sent (end unless closed).
+    template<typename T>
+    template<typename Iter>
+    Iter Channel<T>::pushMany(Iter begin, Iter end) {
+        WaitQueue ready;
+        std::unique_lock<std::mutex> lock(_mutex);
+        while(begin != end) {
+            _notFull.wait(lock, [this]() { return (_closed || _count < _capacity); });
+            if(_closed) {
+                break;
+            }
+            while(begin != end && _count < _capacity) {
+                deliver(valueType(*begin), ready);
+                ++begin;
+            }
+            if(begin != end) {
+                lock.unlock();
+                _notEmpty.notify_all();
+                resume(ready);
+                lock.lock();
+            }
+        }
+        lock.unlock();
+        _notEmpty.notify_all();
+        resume(ready);
+        return begin;
+    }
+
+    // Returns false once the channel is closed and drained.
+    template<typename T>
+    bool Channel<T>::pop(valueType& value) {
+        WaitQueue ready;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _notEmpty.wait(lock, [this]() { return (_closed || _count > 0); });
+            if(_count == 0) {
+                return false;
+            }
+            value = take(ready);
+        }
+        _notFull.notify_one();
+        resume(ready);
+        return true;
+    }
+
+    template<typename T>
+    bool Channel<T>::tryPop(valueType& value) {
+        WaitQueue ready;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if(_count == 0) {
+                return false;
+            }
+            value = take(ready);
+        }
+        _notFull.notify_one();
+        resume(ready);
+        return true;
+    }
+
+    // Waits for at least one value, then moves up to n of them to out under
+    // a single lock. Returns the number written: 0 once closed and drained,
+    // or right away without waiting when n <= 0.
+    template<typename T>
+    template<typename OutIter>
+    typename Channel<T>::sizeType Channel<T>::popMany(OutIter out, sizeType n) {
+        if(n <= 0) {
+            return 0;
+        }
+        WaitQueue ready;
+        sizeType taken{};
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _notEmpty.wait(lock, [this]() { return (_closed || _count > 0); });
+            while(taken < n && _count > 0) {
+                *out = take(ready);
+                ++out;
+                ++taken;
+            }
+        }
+        if(taken > 0) {
+            _notFull.notify_all();
+        }
+        resume(ready);
+        return taken;
+    }
+
+    template<typename T>
+    bool Channel<T>::suspendSender(SendAwaiter* sender, std::coroutine_handle<> handle) {
+        WaitQueue ready;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if(_closed) {
+                return false;
+            }
+            if(_count == _capacity) {
+                sender->_handle = handle;
+                _senders.push(sender);
+                return true;
+            }
+            deliver(std::move(sender->_value), ready);
+            sender->_ok = true;
+        }
+        _notEmpty.notify_one();
+        resume(ready);
+        return false;
+    }
+
+    template<typename T>
+    bool Channel<T>::suspendReceiver(ReceiveAwaiter* receiver, std::coroutine_handle<> handle) {
+        WaitQueue ready;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if(_count == 0) {
+                if(_closed) {
+                    return false;
+                }
+                receiver->_handle = handle;
+                _receivers.push(receiver);
+                return true;
+            }
+            receiver->_value.emplace(take(ready));
+        }
+        _notFull.notify_one();
+        resume(ready);
+        return false;
+    }
+
+    // Callers hold _mutex. A suspended receiver gets the value directly,
+    // otherwise it is queued.
+    template<typename T>
+    void Channel<T>::deliver(valueType&& value, WaitQueue& ready) {
+        if(!_receivers.empty()) {
+            ReceiveAwaiter* receiver = static_cast<ReceiveAwaiter*>(_receivers.pop());
+            receiver->_value.emplace(std::move(value));
+            ready.push(receiver);
+        } else {
+            _items.pushBack(std::move(value));
+            ++_count;
+        }
+    }
+
+    // Callers hold _mutex and _count > 0. The freed slot goes to the oldest
+    // suspended sender, if any. Its value is queued before anything is
+    // dequeued, so a throwing pushBack leaves the channel unchanged.
+    template<typename T>
+    typename Channel<T>::valueType Channel<T>::take(WaitQueue& ready) {
+        if(!_senders.empty()) {
+            SendAwaiter* sender = static_cast<SendAwaiter*>(_senders._first);
+            _items.pushBack(std::move(sender->_value));
+            _senders.pop();
+            ++_count;
+            sender->_ok = true;
+            ready.push(sender);
+        }
+        valueType value = std::move(_items.front());
+        _items.popFront();
+        --_count;
+        return value;
+    }
+
+    template<typename T>
+    void Channel<T>::resume(WaitQueue& ready) {
+        while(!ready.empty()) {
+            ready.pop()->_handle.resume();
+        }
+    }
+};
+
+#endif
@@ -3,15 +3,23 @@
 
 #include <iostream>
 #include <iterator>
+#include <type_traits>
+#include <utility>
 
 namespace LAZ {
     template<typename T>
     class List {
     private:
+        struct SentinelTag {};
         struct Node {
         public:
             Node() : _next{nullptr}, _prev{nullptr}, _value{} {}
             Node(const T& elem) : _value{elem}, _next{nullptr}, _prev{nullptr} {}
+            Node(T&& elem) : _next{nullptr}, _prev{nullptr}, _value{std::move(elem)} {}
+            // List never reads the end node's value; pushBack assigns it when the
+            // node becomes an element. So it is default- rather than value-initialized
+            // (no zeroing for trivial T). Dereferencing end() stays invalid.
+            Node(SentinelTag) : _next{nullptr}, _prev{nullptr} {}
         public:
             Node* _next;
             Node* _prev;
@@ -75,6 +83,7 @@ namespace LAZ {
         template<typename Iter>
         void assign(Iter begin, Iter end);
         void pushBack(constReference value);
+        void pushBack(valueType&& value);
         void pushFront(constReference value);
         void popBack();
         void popFront();
@@ -119,7 +128,7 @@ namespace LAZ {
             tmp = tmp->_next;
         }
         _begin = _head;
-        tmp->_next = new Node();
+        tmp->_next = new Node(SentinelTag{});
         tmp->_next->_prev = tmp;
         _end = tmp->_next;
     }
@@ -134,7 +143,7 @@ namespace LAZ {
             tmp = tmp->_next;
         }
         _begin = _head;
-        tmp->_next = new Node();
+        tmp->_next = new Node(SentinelTag{});
         tmp->_next->_prev = tmp;
         _end = tmp->_next;
     }
@@ -151,24 +160,29 @@ namespace LAZ {
             tmp = tmp->_next;
         }
         _begin = _head;
-        tmp->_next = new Node();
+        tmp->_next = new Node(SentinelTag{});
         tmp->_next->_prev = tmp;
         _end = tmp->_next;
     }
 
     template<typename T>
-    List<T>::List(const List<valueType>& oth) {
+    List<T>::List(const List<valueType>& oth) : _head{nullptr} {
+        if(oth.empty()) {
+            return;
+        }
         Node* tmp = oth._head;
         _head = new Node(tmp->_value);
         Node* tmp1 = _head;
-        while(tmp->_next != nullptr) {
+        while(tmp->_next != oth._end.getIter()) {
             tmp = tmp->_next;
             tmp1->_next = new Node(tmp->_value);
-            tmp->_next->_prev = tmp;
+            tmp1->_next->_prev = tmp1;
             tmp1 = tmp1->_next;
         }
         _begin = _head;
-        _end = tmp1;
+        tmp1->_next = new Node(SentinelTag{});
+        tmp1->_next->_prev = tmp1;
+        _end = tmp1->_next;
     }
 
     template<typename T>
@@ -193,7 +207,7 @@ namespace LAZ {
             tmp = tmp->_next;
         }
         _begin = _head;
-        tmp->_next = new Node();
+        tmp->_next = new Node(SentinelTag{});
         tmp->_next->_prev = tmp;
         _end = tmp->_next;
     }
@@ -205,17 +219,22 @@ namespace LAZ {
             return *this;
         }
         clear();
+        if(rhs.empty()) {
+            return *this;
+        }
         _head = new Node(rhs._head->_value);
         Node* tmp = rhs._head;
         Node* tmp1 = _head;
-        while(tmp->_next != nullptr) {
+        while(tmp->_next != rhs._end.getIter()) {
             tmp = tmp->_next;
             tmp1->_next = new Node(tmp->_value);
-            tmp->_next->_prev = tmp;
+            tmp1->_next->_prev = tmp1;
             tmp1 = tmp1->_next;
         }
         _begin = _head;
-        _end = tmp1;
+        tmp1->_next = new Node(SentinelTag{});
+        tmp1->_next->_prev = tmp1;
+        _end = tmp1->_next;
         return *this;
     }
 
@@ -243,7 +262,7 @@ namespace LAZ {
             tmp = tmp->_next;
         }
         _begin = _head;
-        tmp->_next = new Node();
+        tmp->_next = new Node(SentinelTag{});
         tmp->_next->_prev = tmp;
         _end = tmp->_next;
         return *this;
@@ -253,14 +272,14 @@ namespace LAZ {
     bool List<T>::operator==(const List<valueType>& rhs) {
         auto it = _begin;
         auto iter = rhs.begin();
-        while(it != _end) {
+        while(it != _end && iter != rhs.end()) {
             if(*it != *iter) {
                 return false;
             }
             ++it;
             ++iter;
         }
-        return true;
+        return (it == _end && iter == rhs.end());
     }
 
     template<typename T>
@@ -326,7 +345,7 @@ namespace LAZ {
             tmp = tmp->_next;
         }
         _begin = _head;
-        tmp->_next = new Node();
+        tmp->_next = new Node(SentinelTag{});
         tmp->_next->_prev = tmp;
         _end = tmp->_next;
     }
@@ -344,7 +363,7 @@ namespace LAZ {
             tmp = tmp->_next;
         }
         _begin = _head;
-        tmp->_next = new Node();
+        tmp->_next = new Node(SentinelTag{});
         tmp->_next->_prev = tmp;
         _end = tmp->_next;
     }
@@ -363,7 +382,7 @@ namespace LAZ {
             ++begin;
         }
         _begin = _head;
-        tmp->_next = new Node();
+        tmp->_next = new Node(SentinelTag{});
         tmp->_next->_prev = tmp;
         _end = tmp->_next;
     }
@@ -372,23 +391,44 @@ namespace LAZ {
     void List<T>::pushBack(constReference value) {
         if(empty()) {
             _head = new Node(value);
-            _head->_next = new Node();
+            _head->_next = new Node(SentinelTag{});
+            _head->_next->_prev = _head;
             _begin = _head;
             _end = _head->_next;
         } else {
             Node* tmp = _end.getIter();
             tmp->_value = value;
-            tmp->_next = new Node();
+            tmp->_next = new Node(SentinelTag{});
             tmp->_next->_prev = tmp;
             _end = tmp->_next;
         }
     }
 
+    template<typename T>
+    void List<T>::pushBack(valueType&& value) {
+        if(empty()) {
+            _head = new Node(std::move(value));
+            _head->_next = new Node(SentinelTag{});
+            _head->_next->_prev = _head;
+            _begin = _head;
+            _end = _head->_next;
+        } else {
+            // Allocate the new end node first so a throwing new leaves value untouched.
+            Node* sentinel = new Node(SentinelTag{});
+            Node* tmp = _end.getIter();
+            tmp->_value = std::move(value);
+            tmp->_next = sentinel;
+            sentinel->_prev = tmp;
+            _end = sentinel;
+        }
+    }
+
     template<typename T>
     void List<T>::pushFront(constReference value) {
         if(empty()) {
             _head = new Node(value);
-            _head->_next = new Node();
+            _head->_next = new Node(SentinelTag{});
+            _head->_next->_prev = _head;
             _begin = _head;
             _end = _head->_next;
         } else {
@@ -403,9 +443,16 @@ namespace LAZ {
     template<typename T>
     void List<T>::popBack() {
         if(!empty()) {
+            if(_head->_next == _end.getIter()) {
+                clear();
+                return;
+            }
             Node* tmp = _end.getIter()->_prev;
             delete _end.getIter();
-            tmp->_value = {};
+            // tmp becomes the end node; only release what its value owns.
+            if constexpr(!std::is_trivially_destructible_v<T>) {
+                tmp->_value = {};
+            }
             tmp->_next = nullptr;
             _end = tmp;
         }
@@ -414,11 +461,14 @@ namespace LAZ {
     template<typename T>
     void List<T>::popFront() {
         if(!empty()) {
+            if(_head->_next == _end.getIter()) {
+                clear();
+                return;
+            }
             Node* tmp = _head;
             _head = _head->_next;
             _begin = _head;
             _head->_prev = nullptr;
-            tmp->_value = {};
             delete tmp;
         }
     }
@@ -556,9 +606,12 @@ namespace LAZ {
 
     template<typename T>
     void List<T>::remove(constReference value) {
-        while(*_begin == value) {
+        while(!empty() && *_begin == value) {
             popFront();
         }
+        if(empty()) {
+            return;
+        }
         Iterator tmp = _begin;
         ++tmp;
         while(tmp != _end) {
@@ -572,9 +625,12 @@ namespace LAZ {
     template<typename T>
     template<typename Operation>
     void List<T>::removeIf(Operation op) {
-        while(op(*_begin)) {
+        while(!empty() && op(*_begin)) {
             popFront();
         }
+        if(empty()) {
+            return;
+        }
         Iterator tmp = _begin;
         ++tmp;
         while(tmp != _end) {
@@ -587,16 +643,10 @@ namespace LAZ {
 
     template<typename T>
     void List<T>::clear() {
-        if(_head != nullptr) {
+        while(_head != nullptr) {
             Node* tmp = _head->_next;
             delete _head;
-            _head = nullptr;
-            while(tmp->_next != nullptr) {
-                _head = tmp;
-                tmp = tmp->_next;
-                delete _head;
-                _head = nullptr;
-            }
+            _head = tmp;
         }
         _begin = nullptr;
         _end = nullptr;
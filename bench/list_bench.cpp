@@ -0,0 +1,76 @@
+// g++ -std=c++20 -O2 -I.. list_bench.cpp -o list_bench && ./list_bench
+//
+// To compare against another revision, build the same file against that
+// revision's List.hpp:
+//   git worktree add /tmp/list-base <rev>
+//   g++ -std=c++20 -O2 -I/tmp/list-base list_bench.cpp -o list_bench_base && ./list_bench_base
+//
+// Only pushBack/popFront are used so that older revisions run it too.
+//
+// Revisions before the clear() fix leak the end node, which pins the top of
+// the glibc heap and stops free() from trimming it. Newer revisions then
+// pay page faults on every round that older ones do not. Disable trimming
+// when comparing across that fix:
+//   GLIBC_TUNABLES=glibc.malloc.trim_threshold=1000000000 ./list_bench
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+#include "List.hpp"
+
+namespace {
+    struct Pod {
+        int a;
+        double b;
+        char c[48];
+    };
+
+    struct BigPod {
+        char data[1024];
+    };
+
+    const int kElements = 20000;
+    const int kRounds = 50;
+    const int kSamples = 21;
+
+    long long sink{};
+
+    // One sample: kRounds times, fill a list with kElements pushBacks,
+    // then popFront all but one element and let the destructor free the rest.
+    template<typename T>
+    double sample() {
+        auto start = std::chrono::steady_clock::now();
+        for(int r = 0; r < kRounds; ++r) {
+            LAZ::List<T> ls;
+            for(int i = 0; i < kElements; ++i) {
+                ls.pushBack(T{});
+            }
+            for(int i = 0; i < kElements - 1; ++i) {
+                ls.popFront();
+            }
+            sink += ls.size();
+        }
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    template<typename T>
+    void run(const char* name) {
+        sample<T>();
+        std::vector<double> times;
+        for(int s = 0; s < kSamples; ++s) {
+            times.push_back(sample<T>());
+        }
+        std::sort(times.begin(), times.end());
+        std::printf("%-10s min %7.2f ms  median %7.2f ms  max %7.2f ms\n",
+                    name, times.front(), times[times.size() / 2], times.back());
+    }
+}
+
+int main() {
+    std::printf("%d rounds x %d pushBack/popFront, %d samples\n", kRounds, kElements, kSamples);
+    run<int>("List<int>");
+    run<Pod>("List<Pod>");
+    run<BigPod>("List<Big>");
+    return (sink == 0);
+}
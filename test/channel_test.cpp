@@ -0,0 +1,197 @@
+// g++ -std=c++20 -O1 -g -fsanitize=address,undefined -pthread -I.. channel_test.cpp -o channel_test && ./channel_test
+// g++ -std=c++20 -O1 -g -fsanitize=thread -pthread -I.. channel_test.cpp -o channel_test_tsan && ./channel_test_tsan
+
+#include <coroutine>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Channel.hpp"
+
+namespace {
+    void check(bool cond, const char* what) {
+        if(!cond) {
+            std::fprintf(stderr, "FAILED: %s\n", what);
+            std::abort();
+        }
+    }
+
+    // Eager, fire-and-forget coroutine: runs until its first real suspension.
+    struct Task {
+        struct promise_type {
+            Task get_return_object() { return {}; }
+            std::suspend_never initial_suspend() { return {}; }
+            std::suspend_never final_suspend() noexcept { return {}; }
+            void return_void() {}
+            void unhandled_exception() { std::abort(); }
+        };
+    };
+
+    Task produce(LAZ::Channel<int>& ch, int n, int& sent) {
+        for(int i = 1; i <= n; ++i) {
+            if(!(co_await ch.send(i))) {
+                co_return;
+            }
+            ++sent;
+        }
+    }
+
+    Task consume(LAZ::Channel<int>& ch, long long& sum, int& received, bool& done) {
+        while(std::optional<int> v = co_await ch.receive()) {
+            sum += *v;
+            ++received;
+        }
+        done = true;
+    }
+
+    void coroutineSendReceive() {
+        LAZ::Channel<int> ch(4);
+        long long sum{};
+        int received{}, sent{};
+        bool done{false};
+        consume(ch, sum, received, done);
+        produce(ch, 1000, sent);
+        check(sent == 1000 && received == 1000 && sum == 500500, "coroutine send/receive");
+        check(!done, "receiver still suspended before close");
+        ch.close();
+        check(done, "receiver resumed by close");
+    }
+
+    void coroutineReceiverFromThreads() {
+        LAZ::Channel<int> ch(2);
+        long long sum{};
+        int received{};
+        bool done{false};
+        consume(ch, sum, received, done);
+        std::vector<std::thread> producers;
+        for(int t = 0; t < 4; ++t) {
+            producers.emplace_back([&ch]() {
+                for(int i = 1; i <= 5000; ++i) {
+                    ch.push(i);
+                }
+            });
+        }
+        for(auto& p : producers) {
+            p.join();
+        }
+        ch.close();
+        check(done && received == 20000 && sum == 4LL * 12502500, "coroutine receiver fed by threads");
+    }
+
+    void closeWithSuspendedSenders() {
+        LAZ::Channel<int> ch(2);
+        int sent1{}, sent2{};
+        produce(ch, 10, sent1);
+        produce(ch, 10, sent2);
+        check(sent1 == 2 && sent2 == 0 && ch.size() == 2, "senders suspended on full channel");
+        ch.close();
+        check(sent1 == 2 && sent2 == 0, "suspended sends fail on close");
+        int v{};
+        check(ch.pop(v) && v == 1 && ch.pop(v) && v == 2, "queued values drain after close");
+        check(!ch.pop(v), "pop fails once closed and drained");
+        check(!ch.push(3), "push fails once closed");
+    }
+
+    void closeWithSuspendedReceivers() {
+        LAZ::Channel<int> ch(2);
+        long long sum{};
+        int received{};
+        bool done1{false}, done2{false};
+        consume(ch, sum, received, done1);
+        consume(ch, sum, received, done2);
+        check(!done1 && !done2, "receivers suspended on empty channel");
+        ch.close();
+        check(done1 && done2 && received == 0, "suspended receives get nullopt on close");
+    }
+
+    void destroyWithSuspendedReceiver() {
+        long long sum{};
+        int received{};
+        bool done{false};
+        {
+            LAZ::Channel<int> ch(1);
+            consume(ch, sum, received, done);
+        }
+        check(done, "destruction resumes suspended receiver");
+    }
+
+    void batchedThreads() {
+        LAZ::Channel<std::string> ch(16);
+        std::vector<std::string> in(20000);
+        for(int i = 0; i < 20000; ++i) {
+            in[i] = std::to_string(i);
+        }
+        long long total{};
+        std::thread producer([&]() {
+            check(ch.pushMany(in.begin(), in.end()) == in.end(), "pushMany sends everything");
+            ch.close();
+        });
+        std::vector<std::string> out(64);
+        int k{}, expected{};
+        bool ordered{true};
+        while((k = ch.popMany(out.begin(), 64)) > 0) {
+            for(int i = 0; i < k; ++i) {
+                ordered = ordered && (out[i] == std::to_string(expected++));
+            }
+            total += k;
+        }
+        producer.join();
+        check(total == 20000 && ordered, "pushMany/popMany keep FIFO order");
+        check(ch.popMany(out.begin(), 0) == 0, "popMany with n == 0");
+    }
+
+    void manyToMany() {
+        LAZ::Channel<std::string> ch(8);
+        std::vector<std::thread> threads;
+        std::vector<long long> sums(4);
+        for(int c = 0; c < 4; ++c) {
+            threads.emplace_back([&ch, &sums, c]() {
+                std::string v;
+                while(ch.pop(v)) {
+                    sums[c] += std::stoll(v);
+                }
+            });
+        }
+        std::vector<std::thread> producers;
+        for(int p = 0; p < 4; ++p) {
+            producers.emplace_back([&ch]() {
+                for(int i = 1; i <= 5000; ++i) {
+                    ch.push(std::to_string(i));
+                }
+            });
+        }
+        for(auto& p : producers) {
+            p.join();
+        }
+        ch.close();
+        for(auto& t : threads) {
+            t.join();
+        }
+        check(sums[0] + sums[1] + sums[2] + sums[3] == 4LL * 12502500, "4 producers x 4 consumers");
+    }
+
+    void moveOnly() {
+        LAZ::Channel<std::unique_ptr<int>> ch(2);
+        check(ch.push(std::make_unique<int>(7)), "push move-only value");
+        std::unique_ptr<int> v;
+        check(ch.pop(v) && v && *v == 7, "pop move-only value");
+        check(ch.tryPush(std::make_unique<int>(8)), "tryPush move-only value");
+        check(ch.tryPop(v) && v && *v == 8, "tryPop move-only value");
+    }
+}
+
+int main() {
+    coroutineSendReceive();
+    coroutineReceiverFromThreads();
+    closeWithSuspendedSenders();
+    closeWithSuspendedReceivers();
+    destroyWithSuspendedReceiver();
+    batchedThreads();
+    manyToMany();
+    moveOnly();
+    std::puts("channel_test: ok");
+    return 0;
+}
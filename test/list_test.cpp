@@ -0,0 +1,116 @@
+// g++ -std=c++20 -O1 -g -fsanitize=address,undefined -I.. list_test.cpp -o list_test && ./list_test
+
+#include <cstdio>
+#include <cstdlib>
+#include <type_traits>
+#include "List.hpp"
+
+namespace {
+    void check(bool cond, const char* what) {
+        if(!cond) {
+            std::fprintf(stderr, "FAILED: %s\n", what);
+            std::abort();
+        }
+    }
+
+    struct Pod {
+        int a;
+        double b;
+        char c[48];
+    };
+
+    bool operator==(const Pod& lhs, const Pod& rhs) { return (lhs.a == rhs.a && lhs.b == rhs.b); }
+    bool operator!=(const Pod& lhs, const Pod& rhs) { return !(lhs == rhs); }
+
+    template<typename T>
+    T make(int i) {
+        if constexpr(std::is_same_v<T, Pod>) {
+            Pod p{};
+            p.a = i;
+            p.b = i * 0.5;
+            return p;
+        } else {
+            return T(i);
+        }
+    }
+
+    template<typename T>
+    LAZ::List<T> build(int n) {
+        LAZ::List<T> ls;
+        for(int i = 1; i <= n; ++i) {
+            ls.pushBack(make<T>(i));
+        }
+        return ls;
+    }
+
+    template<typename T>
+    void copying() {
+        LAZ::List<T> empty;
+        LAZ::List<T> emptyCopy(empty);
+        check(emptyCopy.empty() && emptyCopy.size() == 0, "copy of empty list is empty");
+
+        LAZ::List<T> src = build<T>(3);
+        LAZ::List<T> copy(src);
+        check(copy.size() == 3, "size() on a copy");
+        check(copy.front() == make<T>(1) && copy.back() == make<T>(3), "front()/back() on a copy");
+        copy.popBack();
+        check(copy.back() == make<T>(2) && src.back() == make<T>(3), "popBack on a copy leaves the source alone");
+
+        LAZ::List<T> assigned = build<T>(5);
+        assigned = src;
+        check(assigned.size() == 3 && assigned.back() == make<T>(3), "copy assignment from non-empty");
+        assigned = empty;
+        check(assigned.empty() && assigned.size() == 0, "copy assignment from empty");
+        assigned = assigned;
+        check(assigned.empty(), "self assignment");
+    }
+
+    template<typename T>
+    void popToEmpty() {
+        LAZ::List<T> back = build<T>(3);
+        back.popBack();
+        back.popBack();
+        back.popBack();
+        check(back.empty() && back.size() == 0, "popBack to empty");
+        back.popBack();
+        check(back.empty(), "popBack on empty list");
+        back.pushBack(make<T>(7));
+        check(back.size() == 1 && back.front() == make<T>(7) && back.back() == make<T>(7), "pushBack after popBack to empty");
+
+        LAZ::List<T> front = build<T>(3);
+        front.popFront();
+        front.popFront();
+        front.popFront();
+        check(front.empty() && front.size() == 0, "popFront to empty");
+        front.pushFront(make<T>(8));
+        front.pushBack(make<T>(9));
+        check(front.size() == 2 && front.front() == make<T>(8) && front.back() == make<T>(9), "push after popFront to empty");
+    }
+
+    template<typename T>
+    void comparing() {
+        LAZ::List<T> shorter = build<T>(2);
+        LAZ::List<T> longer = build<T>(3);
+        LAZ::List<T> same = build<T>(3);
+        LAZ::List<T> empty;
+        check(!(longer == shorter) && longer != shorter, "longer vs prefix");
+        check(!(shorter == longer) && shorter != longer, "prefix vs longer");
+        check(longer == same && !(longer != same), "equal lists");
+        check(!(empty == shorter) && !(shorter == empty), "empty vs non-empty");
+        check(empty == empty, "empty vs empty");
+    }
+
+    template<typename T>
+    void run() {
+        copying<T>();
+        popToEmpty<T>();
+        comparing<T>();
+    }
+}
+
+int main() {
+    run<int>();
+    run<Pod>();
+    std::puts("list_test: ok");
+    return 0;
+}